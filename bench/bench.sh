@@ -0,0 +1,84 @@
+#!/bin/sh
+#
+# bench.sh -- Run the newsd benchmark ("make bench")
+#
+# Copyright 2003-2004 Michael Sweet
+# Copyright 2002 Greg Ercolano
+#
+# This program is free software; you can redistribute it and/or modify
+# it under the terms of the GNU General Public Licensse as published by
+# the Free Software Foundation; either version 2 of the License, or
+# (at your option) any later version.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with this program; if not, write to the Free Software
+# Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+#
+# Builds a synthetic spool under bench/run, starts ./newsd on it on a
+# spare port, and runs nntpbench against it, once per mix. Settings
+# come from the environment (or make command line):
+#
+#    BENCH_GROUPS=20       groups in the spool
+#    BENCH_ARTICLES=500    articles per group
+#    BENCH_CONNS=8         concurrent connections
+#    BENCH_TIME=10         seconds per mix
+#    BENCH_MODE=fork       newsd ServerMode (fork or event)
+#    BENCH_PORT=11999      port to run newsd on
+#    BENCH_MIXES="..."     space separated nntpbench mixes
+#
+
+NGROUPS=${BENCH_GROUPS:-20}
+NARTICLES=${BENCH_ARTICLES:-500}
+CONNS=${BENCH_CONNS:-8}
+TIME=${BENCH_TIME:-10}
+MODE=${BENCH_MODE:-fork}
+PORT=${BENCH_PORT:-11999}
+MIXES=${BENCH_MIXES:-"list:1,group:10,xover:20,article:40,msgid:20,post:5 article:1 xover:1 post:1"}
+
+RUN=`pwd`/bench/run
+NEWSD=`pwd`/newsd
+
+rm -rf $RUN
+mkdir -p $RUN || exit 1
+
+bench/mkspool -g $NGROUPS -a $NARTICLES $RUN/spool || exit 1
+
+cat >$RUN/newsd.conf <<EOC
+ErrorLog $RUN/log
+LogLevel error
+Listen 127.0.0.1:$PORT
+ServerName bench.invalid
+SpoolDir $RUN/spool
+SendMail /bin/cat >/dev/null
+ServerMode $MODE
+User `id -un`
+EOC
+
+echo "Building overview, history and active file..."
+$NEWSD -c $RUN/newsd.conf -rebuild >/dev/null || exit 1
+
+# Start newsd in a process group of its own (setsid), so its logger,
+# workers and sessions all go with it, however we exit. Without
+# setsid, kill its children and then it.
+if command -v setsid >/dev/null 2>&1; then
+	setsid $NEWSD -c $RUN/newsd.conf -f &
+else
+	$NEWSD -c $RUN/newsd.conf -f &
+fi
+pid=$!
+trap "kill -- -$pid 2>/dev/null || { pkill -P $pid; kill $pid; } 2>/dev/null" 0
+trap "exit 1" 1 2 13 15
+
+status=0
+for mix in $MIXES; do
+	echo ""
+	echo "Mix $mix ($MODE mode):"
+	bench/nntpbench -p $PORT -c $CONNS -t $TIME -m $mix || status=1
+done
+
+exit $status
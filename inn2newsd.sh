@@ -55,3 +55,9 @@ for group in `find . -type d -print`; do
 		;;
 	esac
 done
+
+echo Converting articles to wire format...
+newsd -convert
+
+echo Building Newsd .info and overview files...
+newsd -rebuild